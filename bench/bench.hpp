@@ -0,0 +1,114 @@
+#ifndef CHENC_BIG_INT_BENCH_HPP
+#define CHENC_BIG_INT_BENCH_HPP
+
+#include "../fraction.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief 基准程序共用的计时与数据生成
+ * @note 操作数全部由 big_uint::random_bits 按种子生成，同一种子在任何线程数下得到相同数据；
+ *       程序第一个参数可指定种子，输出的校验和用于确认两次运行的数据一致
+ */
+namespace chenc::big_int::bench
+{
+    // 默认种子
+    inline constexpr uint64_t default_seed = 0x5eed'b16'0001;
+
+    /**
+     * @brief 从命令行读取种子
+     * @param argc 参数个数
+     * @param argv 参数
+     * @return 第一个参数（十进制或 0x 十六进制），缺省时为 default_seed
+     */
+    inline uint64_t seed_from_args(const int &argc, char **argv)
+    {
+        const uint64_t seed = argc > 1 ? std::strtoull(argv[1], nullptr, 0) : default_seed;
+        std::printf("seed %#llx\n", static_cast<unsigned long long>(seed));
+        return seed;
+    }
+    /**
+     * @brief 生成 count 个恰好 bits 位（最高位为 1）的随机数
+     * @param count 个数
+     * @param bits 位数（大于 0）
+     * @param seed 种子
+     * @return 随机数数组
+     */
+    inline std::vector<big_uint> random_operands(const uint64_t &count, const uint64_t &bits, const uint64_t &seed)
+    {
+        std::vector<big_uint> result(count);
+        big_uint::random_bits(result, bits - 1, seed);
+        for (big_uint &value : result)
+            value.bit_set(bits - 1, true);
+        return result;
+    }
+    /**
+     * @brief 生成 count 个分子分母均恰好 bits 位的随机正分数（eager，已化简）
+     * @param count 个数
+     * @param bits 分子分母的位数
+     * @param seed 种子
+     * @return 随机分数数组，精度上限足以保存精确值
+     */
+    inline std::vector<fraction> random_fractions(const uint64_t &count, const uint64_t &bits, const uint64_t &seed)
+    {
+        const std::vector<big_uint> parts = random_operands(2 * count, bits, seed);
+        std::vector<fraction> result;
+        result.reserve(count);
+        for (uint64_t i = 0; i < count; i++)
+            result.emplace_back(parts[2 * i], parts[2 * i + 1], UINT64_MAX);
+        return result;
+    }
+    /**
+     * @brief 数组的校验和
+     * @param values 大整数数组
+     * @return 各元素哈希的组合
+     */
+    inline uint64_t checksum(const std::vector<big_uint> &values)
+    {
+        uint64_t sum = 0;
+        for (const big_uint &value : values)
+            sum = chenc::tools::hash_mix(sum ^ big_uint_hash{}(value), 0x9e3779b97f4a7c15);
+        return sum;
+    }
+    /**
+     * @brief 反复执行 fn 直到累计至少 min_ms 毫秒
+     * @param fn 被测函数，每次调用算作一次操作
+     * @param min_ms 最短计时
+     * @return 每次调用的平均纳秒数
+     */
+    template <typename F>
+    inline double measure(F &&fn, const double &min_ms = 200.0)
+    {
+        using clock = std::chrono::steady_clock;
+        uint64_t calls = 0;
+        const clock::time_point start = clock::now();
+        double elapsed = 0;
+        do
+        {
+            fn();
+            ++calls;
+            elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        } while (elapsed < min_ms * 1e6);
+        return elapsed / calls;
+    }
+    /**
+     * @brief 输出一行结果
+     * @param name 项目名称
+     * @param ns 每次操作的纳秒数
+     */
+    inline void report(const char *name, const double &ns)
+    {
+        if (ns < 1e4)
+            std::printf("  %-44s %10.1f ns\n", name, ns);
+        else if (ns < 1e7)
+            std::printf("  %-44s %10.2f us\n", name, ns / 1e3);
+        else
+            std::printf("  %-44s %10.2f ms\n", name, ns / 1e6);
+    }
+}
+
+#endif
@@ -0,0 +1,101 @@
+// 分数乘法基准：交叉约分（fraction::operator*=）与先乘后求 gcd 的对比
+// 两两相乘与连乘两种情形，操作数为按种子生成的随机分数
+// 运行：bench/run_bench.sh [种子]
+#include "bench.hpp"
+
+using namespace chenc::big_int;
+
+namespace
+{
+    /**
+     * @brief 旧做法：分子分母分别相乘，再对整个乘积求 gcd 化简
+     */
+    void multiply_then_gcd(big_uint &numerator, big_uint &denominator, const fraction &value)
+    {
+        numerator *= value.numerator();
+        denominator *= value.denominator();
+        const big_uint gcd = big_uint::gcd(numerator, denominator);
+        if (!gcd.is_one())
+        {
+            numerator /= gcd;
+            denominator /= gcd;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const uint64_t seed = bench::seed_from_args(argc, argv);
+
+    std::printf("pairwise products of random rationals (1024 pairs)\n");
+    for (const uint64_t bits : {64, 256, 1024, 4096})
+    {
+        const std::vector<fraction> left = bench::random_fractions(1024, bits, seed);
+        const std::vector<fraction> right = bench::random_fractions(1024, bits, seed + 1);
+
+        uint64_t mismatches = 0;
+        for (uint64_t i = 0; i < left.size(); i++)
+        {
+            big_uint numerator = left[i].numerator(), denominator = left[i].denominator();
+            multiply_then_gcd(numerator, denominator, right[i]);
+            const fraction product = left[i] * right[i];
+            mismatches += product.numerator() != numerator or product.denominator() != denominator;
+        }
+
+        fraction sink;
+        const auto cross_cancel = [&]
+        {
+            for (uint64_t i = 0; i < left.size(); i++)
+                sink = left[i] * right[i];
+        };
+        const auto full_gcd = [&]
+        {
+            for (uint64_t i = 0; i < left.size(); i++)
+            {
+                big_uint numerator = left[i].numerator(), denominator = left[i].denominator();
+                multiply_then_gcd(numerator, denominator, right[i]);
+            }
+        };
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%llu-bit parts, cross-cancel", static_cast<unsigned long long>(bits));
+        bench::report(name, bench::measure(cross_cancel) / left.size());
+        std::snprintf(name, sizeof(name), "%llu-bit parts, multiply then gcd", static_cast<unsigned long long>(bits));
+        bench::report(name, bench::measure(full_gcd) / left.size());
+        if (mismatches != 0)
+            std::printf("    %llu results differ\n", static_cast<unsigned long long>(mismatches));
+    }
+
+    std::printf("running product of random rationals\n");
+    for (const uint64_t count : {64, 256, 512})
+    {
+        // 32 位分子分母：乘积逐步增长到 count * 32 位量级
+        const std::vector<fraction> factors = bench::random_fractions(count, 32, seed + count);
+
+        const auto cross_cancel = [&]
+        {
+            fraction product(1, 1, UINT64_MAX);
+            for (const fraction &factor : factors)
+                product *= factor;
+            return product;
+        };
+        const auto full_gcd = [&]
+        {
+            big_uint numerator = 1, denominator = 1;
+            for (const fraction &factor : factors)
+                multiply_then_gcd(numerator, denominator, factor);
+            return std::make_pair(numerator, denominator);
+        };
+        const fraction expected = cross_cancel();
+        const auto [numerator, denominator] = full_gcd();
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%llu factors, cross-cancel", static_cast<unsigned long long>(count));
+        bench::report(name, bench::measure(cross_cancel));
+        std::snprintf(name, sizeof(name), "%llu factors, multiply then gcd", static_cast<unsigned long long>(count));
+        bench::report(name, bench::measure(full_gcd));
+        if (expected.numerator() != numerator or expected.denominator() != denominator)
+            std::printf("    results differ\n");
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+// 随机数生成基准：random_bits / random_below 与旧做法（随机十进制字符串再 from_str）对比，
+// 以及批量生成的多线程吞吐；批量结果与线程数无关，校验和应一致
+// 运行：bench/run_bench.sh [种子]
+#include "bench.hpp"
+
+#include <string>
+#include <thread>
+
+using namespace chenc::big_int;
+
+int main(int argc, char **argv)
+{
+    const uint64_t seed = bench::seed_from_args(argc, argv);
+    chenc::tools::xoshiro256pp rng(seed);
+
+    std::printf("single values\n");
+    for (const uint64_t bits : {64, 1024, 65536})
+    {
+        big_uint sink;
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "random_bits(%llu)", static_cast<unsigned long long>(bits));
+        bench::report(name, bench::measure([&] { sink = big_uint::random_bits(bits, rng); }));
+
+        const big_uint bound = big_uint::random_bits(bits, rng) | (big_uint(1) << (bits - 1));
+        std::snprintf(name, sizeof(name), "random_below(%llu-bit bound)", static_cast<unsigned long long>(bits));
+        bench::report(name, bench::measure([&] { sink = big_uint::random_below(bound, rng); }));
+
+        // 旧做法：逐位生成十进制字符串再解析，位数与 bits 位数相当
+        const uint64_t digits = bits * 30103 / 100000 + 1;
+        std::string text(digits, '0');
+        std::snprintf(name, sizeof(name), "decimal string + from_str (%llu digits)", static_cast<unsigned long long>(digits));
+        const auto parse_random_text = [&]
+        {
+            for (char &c : text)
+                c = static_cast<char>('0' + rng() % 10);
+            sink = big_uint::from_str<10>(text);
+        };
+        bench::report(name, bench::measure(parse_random_text));
+    }
+
+    std::printf("batch random_bits (4096 values x 4096 bits)\n");
+    std::vector<big_uint> values(4096);
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t reference = 0;
+    for (const unsigned threads : {1u, 4u, hardware})
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%u thread(s)", threads);
+        bench::report(name, bench::measure([&] { big_uint::random_bits(values, 4096, seed, threads); }));
+        const uint64_t sum = bench::checksum(values);
+        if (threads == 1)
+            reference = sum;
+        std::printf("    checksum %016llx%s\n", static_cast<unsigned long long>(sum), sum == reference ? "" : "  MISMATCH");
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/bin/sh
+# 编译并运行 bench 目录下的全部基准
+# 用法：bench/run_bench.sh [种子]，同一种子生成相同的操作数
+# 编译器由 CXX 指定（默认 g++），编译参数由 CXXFLAGS 追加，如 CXXFLAGS=-DCHENC_BIG_UINT_COW
+set -u
+
+cd "$(dirname "$0")" || exit 1
+CXX=${CXX:-g++}
+OUT=${TMPDIR:-/tmp}/chenc_big_int_bench
+mkdir -p "$OUT" || exit 1
+
+failed=0
+for source in *.cpp; do
+    name=${source%.cpp}
+    echo "== $name"
+    if ! $CXX -std=c++23 -O2 -march=native -I.. ${CXXFLAGS:-} "$source" -o "$OUT/$name"; then
+        echo "BUILD FAILED: $name"
+        failed=$((failed + 1))
+        continue
+    fi
+    "$OUT/$name" "$@" || failed=$((failed + 1))
+done
+
+exit $((failed != 0))
@@ -0,0 +1,102 @@
+// 小操作数基准：跟踪两个操作数均不超过 64 位（一到两个块）时的快速路径
+// 每项与刚超出快速路径的 96 位操作数对比，两列之差即快速路径的收益
+// 运行：bench/run_bench.sh [种子]
+#include "bench.hpp"
+
+using namespace chenc::big_int;
+
+namespace
+{
+    constexpr uint64_t pairs = 1024;
+
+    /**
+     * @brief 对每一对操作数执行 op，输出每次操作的纳秒数
+     */
+    template <typename T, typename Op>
+    double per_operation(const std::vector<T> &left, const std::vector<T> &right, Op &&op)
+    {
+        const auto all_pairs = [&]
+        {
+            for (uint64_t i = 0; i < left.size(); i++)
+                op(left[i], right[i]);
+        };
+        return bench::measure(all_pairs) / left.size();
+    }
+    /**
+     * @brief 输出一行：快速路径与通用路径的耗时
+     */
+    void row(const char *name, const double &fast, const double &generic)
+    {
+        std::printf("  %-28s %10.1f ns %10.1f ns\n", name, fast, generic);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const uint64_t seed = bench::seed_from_args(argc, argv);
+
+    // big_uint：64 位（快速路径）与 96 位（通用路径）；left >= right，便于减法
+    std::vector<big_uint> left[2], right[2];
+    const uint64_t widths[2] = {64, 96};
+    for (int k = 0; k < 2; k++)
+    {
+        left[k] = bench::random_operands(pairs, widths[k], seed + k);
+        right[k] = bench::random_operands(pairs, widths[k] - 8, seed + k + 2);
+    }
+
+    big_uint sink;
+    uint64_t less = 0;
+    const auto measure_both = [&](const char *name, auto &&op)
+    {
+        row(name, per_operation(left[0], right[0], op), per_operation(left[1], right[1], op));
+    };
+
+    std::printf("big_uint                          64-bit        96-bit\n");
+    measure_both("a + b", [&](const big_uint &a, const big_uint &b) { sink = a + b; });
+    measure_both("a - b", [&](const big_uint &a, const big_uint &b) { sink = a - b; });
+    measure_both("a * b", [&](const big_uint &a, const big_uint &b) { sink = a * b; });
+    measure_both("a / b", [&](const big_uint &a, const big_uint &b) { sink = a / b; });
+    measure_both("a % b", [&](const big_uint &a, const big_uint &b) { sink = a % b; });
+    measure_both("a << 17", [&](const big_uint &a, const big_uint &) { sink = a << 17; });
+    measure_both("a >> 17", [&](const big_uint &a, const big_uint &) { sink = a >> 17; });
+    measure_both("gcd(a, b)", [&](const big_uint &a, const big_uint &b) { sink = big_uint::gcd(a, b); });
+    measure_both("a < b", [&](const big_uint &a, const big_uint &b) { less += a < b; });
+    measure_both("s = a; s += b", [&](const big_uint &a, const big_uint &b)
+                 {
+                     sink = a;
+                     sink += b;
+                 });
+    measure_both("s = a; s *= b", [&](const big_uint &a, const big_uint &b)
+                 {
+                     sink = a;
+                     sink *= b;
+                 });
+
+    // fraction：30 位分子分母的和、积不超过 64 位，走快速路径；48 位时超出
+    std::vector<fraction> fraction_left[2], fraction_right[2];
+    const uint64_t fraction_widths[2] = {30, 48};
+    for (int k = 0; k < 2; k++)
+    {
+        fraction_left[k] = bench::random_fractions(pairs, fraction_widths[k], seed + 4 + k);
+        fraction_right[k] = bench::random_fractions(pairs, fraction_widths[k], seed + 6 + k);
+    }
+
+    fraction fraction_sink;
+    const auto measure_fractions = [&](const char *name, auto &&op)
+    {
+        row(name, per_operation(fraction_left[0], fraction_right[0], op), per_operation(fraction_left[1], fraction_right[1], op));
+    };
+
+    std::printf("fraction                     30-bit parts  48-bit parts\n");
+    measure_fractions("fraction(a.num, b.den)", [&](const fraction &a, const fraction &b)
+                      { fraction_sink = fraction(a.numerator(), b.denominator()); });
+    measure_fractions("a + b", [&](const fraction &a, const fraction &b) { fraction_sink = a + b; });
+    measure_fractions("a * b", [&](const fraction &a, const fraction &b) { fraction_sink = a * b; });
+    measure_fractions("a / b", [&](const fraction &a, const fraction &b) { fraction_sink = a / b; });
+    measure_fractions("a < b", [&](const fraction &a, const fraction &b) { less += a < b; });
+
+    std::printf("checksum %016llx, comparisons true %llu\n",
+                static_cast<unsigned long long>(bench::checksum(left[0]) ^ bench::checksum(left[1])),
+                static_cast<unsigned long long>(less));
+    return 0;
+}
@@ -0,0 +1,472 @@
+#ifndef CHENC_BIG_UINT_ARCHIVE_HPP
+#define CHENC_BIG_UINT_ARCHIVE_HPP
+
+#include "big_uint.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <fstream>
+#include <ranges>
+#include <filesystem>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace chenc::big_int
+{
+    /**
+     * @class big_uint_archive
+     * @brief 大整数归档文件，使用内存映射只读访问
+     * @note 文件布局（全部小端）：
+     * @note [文件头 64 字节] [偏移索引 count * 16 字节] [数据区，每个数的32位块按 64 字节对齐]
+     * @note 读取时不拷贝数据，operator[] 返回直接指向映射内存的 big_uint_view
+     * @note 需要修改时再显式构造 big_uint（big_uint(archive[i])）
+     */
+    class big_uint_archive
+    {
+    public:
+        /**
+         * @brief 文件头
+         */
+        struct header
+        {
+            char magic[8];         // "CHENCBUA"
+            uint32_t version;      // 格式版本
+            uint32_t block_bits;   // 块位宽，固定为 32
+            uint64_t count;        // 数据条目数量
+            uint64_t index_offset; // 偏移索引起始位置（字节）
+            uint64_t data_offset;  // 数据区起始位置（字节）
+            uint64_t file_size;    // 文件总大小（字节）
+            uint64_t reserved[2];  // 保留，写 0
+        };
+        /**
+         * @brief 偏移索引条目
+         */
+        struct index_entry
+        {
+            uint64_t offset; // 数据起始位置（字节，相对文件头）
+            uint64_t blocks; // 32位块数量（0 表示数值 0）
+        };
+        static_assert(sizeof(header) == 64, "chenc::big_int::big_uint_archive header must be 64 bytes");
+        static_assert(sizeof(index_entry) == 16, "chenc::big_int::big_uint_archive index_entry must be 16 bytes");
+
+        inline static constexpr char magic_[8] = {'C', 'H', 'E', 'N', 'C', 'B', 'U', 'A'};
+        inline static constexpr uint32_t version_ = 1;
+        inline static constexpr uint64_t alignment_ = 64;
+
+        // -------- 构造函数 --------
+        /**
+         * @brief 构造一个未打开的归档
+         */
+        inline big_uint_archive() noexcept = default;
+        /**
+         * @brief 打开归档文件
+         * @param path 文件路径
+         */
+        inline explicit big_uint_archive(const std::filesystem::path &path)
+        {
+            open(path);
+        }
+        inline big_uint_archive(const big_uint_archive &) = delete;
+        inline big_uint_archive &operator=(const big_uint_archive &) = delete;
+        /**
+         * @brief 移动构造函数
+         * @param other 源对象（将被关闭）
+         */
+        inline big_uint_archive(big_uint_archive &&other) noexcept
+        {
+            swap(other);
+        }
+        /**
+         * @brief 移动赋值运算符
+         * @param other 源对象（将被关闭）
+         * @return 当前对象引用
+         */
+        inline big_uint_archive &operator=(big_uint_archive &&other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                swap(other);
+            }
+            return *this;
+        }
+        inline ~big_uint_archive()
+        {
+            close();
+        }
+
+        // -------- 文件操作 --------
+        /**
+         * @brief 以只读方式映射归档文件并校验
+         * @param path 文件路径
+         * @note 失败时抛出 std::runtime_error（系统错误）或 invalid_argument（格式错误）
+         */
+        inline void open(const std::filesystem::path &path)
+        {
+            close();
+            map_file(path);
+            try
+            {
+                validate();
+            }
+            catch (...)
+            {
+                close();
+                throw;
+            }
+        }
+        /**
+         * @brief 解除映射，之前返回的视图全部失效
+         */
+        inline void close() noexcept
+        {
+            if (base_ != nullptr)
+            {
+#if defined(_WIN32)
+                UnmapViewOfFile(base_);
+#else
+                munmap(const_cast<unsigned char *>(base_), size_);
+#endif
+            }
+            base_ = nullptr;
+            size_ = 0;
+            count_ = 0;
+            index_ = nullptr;
+        }
+        /**
+         * @brief 是否已打开
+         * @return bool
+         */
+        inline bool is_open() const noexcept
+        {
+            return base_ != nullptr;
+        }
+
+        // -------- 数据访问 --------
+        /**
+         * @brief 条目数量
+         * @return 条目数量
+         */
+        inline uint64_t size() const noexcept
+        {
+            return count_;
+        }
+        /**
+         * @brief 获取第 index 个数的只读视图（不检查越界）
+         * @param index 条目索引
+         * @return 指向映射内存的视图
+         */
+        inline big_uint_view operator[](const uint64_t &index) const noexcept
+        {
+            const index_entry entry = load_entry(index);
+            return big_uint_view(reinterpret_cast<const uint32_t *>(base_ + entry.offset), entry.blocks);
+        }
+        /**
+         * @brief 获取第 index 个数的只读视图
+         * @param index 条目索引
+         * @return 指向映射内存的视图
+         */
+        inline big_uint_view at(const uint64_t &index) const
+        {
+            if (index >= count_)
+                throw invalid_argument("chenc::big_int::big_uint_archive.at index out of range");
+            return (*this)[index];
+        }
+
+        /**
+         * @brief 顺序迭代器，解引用得到 big_uint_view
+         */
+        class iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = big_uint_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = big_uint_view;
+
+            inline iterator() noexcept = default;
+            inline iterator(const big_uint_archive *archive, uint64_t index) noexcept
+                : archive_(archive), index_(index)
+            {
+            }
+            inline big_uint_view operator*() const noexcept
+            {
+                return (*archive_)[index_];
+            }
+            inline big_uint_view operator[](difference_type n) const noexcept
+            {
+                return (*archive_)[index_ + n];
+            }
+            inline iterator &operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+            inline iterator operator++(int) noexcept
+            {
+                iterator result = *this;
+                ++index_;
+                return result;
+            }
+            inline iterator &operator--() noexcept
+            {
+                --index_;
+                return *this;
+            }
+            inline iterator operator--(int) noexcept
+            {
+                iterator result = *this;
+                --index_;
+                return result;
+            }
+            inline iterator &operator+=(difference_type n) noexcept
+            {
+                index_ += n;
+                return *this;
+            }
+            inline iterator &operator-=(difference_type n) noexcept
+            {
+                index_ -= n;
+                return *this;
+            }
+            inline friend iterator operator+(iterator it, difference_type n) noexcept
+            {
+                return it += n;
+            }
+            inline friend iterator operator+(difference_type n, iterator it) noexcept
+            {
+                return it += n;
+            }
+            inline friend iterator operator-(iterator it, difference_type n) noexcept
+            {
+                return it -= n;
+            }
+            inline friend difference_type operator-(const iterator &a, const iterator &b) noexcept
+            {
+                return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+            }
+            inline friend bool operator==(const iterator &a, const iterator &b) noexcept
+            {
+                return a.index_ == b.index_;
+            }
+            inline friend auto operator<=>(const iterator &a, const iterator &b) noexcept
+            {
+                return a.index_ <=> b.index_;
+            }
+
+        private:
+            const big_uint_archive *archive_ = nullptr;
+            uint64_t index_ = 0;
+        };
+        inline iterator begin() const noexcept
+        {
+            return iterator(this, 0);
+        }
+        inline iterator end() const noexcept
+        {
+            return iterator(this, count_);
+        }
+
+        // -------- 写入 --------
+        /**
+         * @brief 将一组大整数写入归档文件
+         * @tparam R 元素可转换为 big_uint_view 的范围（big_uint、big_uint_view 等）
+         * @param path 文件路径（已存在则覆盖）
+         * @param values 待写入的数据
+         * @note 范围会被遍历两次：第一次计算偏移，第二次写入数据
+         */
+        template <std::ranges::forward_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<const R>, big_uint_view>
+        inline static void write(const std::filesystem::path &path, const R &values)
+        {
+            static_assert(std::endian::native == std::endian::little,
+                          "chenc::big_int::big_uint_archive requires a little-endian platform");
+
+            // 计算布局
+            uint64_t count = 0;
+            for (const auto &value : values)
+            {
+                (void)value;
+                count++;
+            }
+            header head{};
+            std::memcpy(head.magic, magic_, sizeof(magic_));
+            head.version = version_;
+            head.block_bits = 32;
+            head.count = count;
+            head.index_offset = sizeof(header);
+            head.data_offset = align_up(head.index_offset + count * sizeof(index_entry));
+
+            std::vector<index_entry> index;
+            index.reserve(count);
+            uint64_t offset = head.data_offset;
+            for (const auto &value : values)
+            {
+                const big_uint_view view = value;
+                index.push_back({offset, view.blocks()});
+                offset = align_up(offset + view.blocks() * sizeof(uint32_t));
+            }
+            head.file_size = offset;
+
+            // 写入文件
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.write cannot open file: " + path.string());
+
+            static constexpr char padding[alignment_] = {};
+            uint64_t written = 0;
+            auto put = [&](const void *data, uint64_t len)
+            {
+                file.write(static_cast<const char *>(data), static_cast<std::streamsize>(len));
+                written += len;
+            };
+            auto pad_to = [&](uint64_t pos)
+            {
+                put(padding, pos - written);
+            };
+
+            put(&head, sizeof(head));
+            if (!index.empty())
+                put(index.data(), index.size() * sizeof(index_entry));
+            uint64_t i = 0;
+            for (const auto &value : values)
+            {
+                const big_uint_view view = value;
+                pad_to(index[i].offset);
+                if (view.blocks() > 0)
+                    put(view.data(), view.blocks() * sizeof(uint32_t));
+                i++;
+            }
+            pad_to(head.file_size);
+
+            if (!file.flush())
+                throw std::runtime_error("chenc::big_int::big_uint_archive.write failed writing file: " + path.string());
+        }
+
+        /**
+         * @brief 交换函数
+         * @param other
+         * @return void
+         */
+        inline void swap(big_uint_archive &other) noexcept
+        {
+            std::swap(base_, other.base_);
+            std::swap(size_, other.size_);
+            std::swap(count_, other.count_);
+            std::swap(index_, other.index_);
+        }
+
+    private:
+        /**
+         * @brief 向上对齐到 alignment_
+         */
+        inline static constexpr uint64_t align_up(uint64_t value) noexcept
+        {
+            return (value + alignment_ - 1) / alignment_ * alignment_;
+        }
+        /**
+         * @brief 读取索引条目（索引区按 16 字节对齐，直接读取）
+         */
+        inline index_entry load_entry(const uint64_t &index) const noexcept
+        {
+            index_entry entry;
+            std::memcpy(&entry, index_ + index * sizeof(index_entry), sizeof(entry));
+            return entry;
+        }
+        /**
+         * @brief 映射文件
+         */
+        inline void map_file(const std::filesystem::path &path)
+        {
+#if defined(_WIN32)
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.open cannot open file: " + path.string());
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file, &file_size) or file_size.QuadPart == 0)
+            {
+                CloseHandle(file);
+                throw invalid_argument("chenc::big_int::big_uint_archive.open file is empty or unreadable");
+            }
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (mapping == nullptr)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.open cannot map file: " + path.string());
+            void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (base == nullptr)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.open cannot map file: " + path.string());
+            base_ = static_cast<const unsigned char *>(base);
+            size_ = static_cast<uint64_t>(file_size.QuadPart);
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.open cannot open file: " + path.string());
+            struct stat st;
+            if (fstat(fd, &st) != 0 or st.st_size <= 0)
+            {
+                ::close(fd);
+                throw invalid_argument("chenc::big_int::big_uint_archive.open file is empty or unreadable");
+            }
+            void *base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (base == MAP_FAILED)
+                throw std::runtime_error("chenc::big_int::big_uint_archive.open cannot map file: " + path.string());
+            base_ = static_cast<const unsigned char *>(base);
+            size_ = static_cast<uint64_t>(st.st_size);
+#endif
+        }
+        /**
+         * @brief 校验文件头与全部索引条目，保证后续访问不会越界
+         */
+        inline void validate()
+        {
+            if (std::endian::native != std::endian::little)
+                throw invalid_argument("chenc::big_int::big_uint_archive.open requires a little-endian platform");
+            if (size_ < sizeof(header))
+                throw invalid_argument("chenc::big_int::big_uint_archive.open file too small");
+
+            header head;
+            std::memcpy(&head, base_, sizeof(head));
+            if (std::memcmp(head.magic, magic_, sizeof(magic_)) != 0)
+                throw invalid_argument("chenc::big_int::big_uint_archive.open bad magic");
+            if (head.version != version_ or head.block_bits != 32)
+                throw invalid_argument("chenc::big_int::big_uint_archive.open unsupported version");
+            if (head.file_size != size_ or head.index_offset % alignof(index_entry) != 0 or
+                head.index_offset > size_ or
+                head.count > (size_ - head.index_offset) / sizeof(index_entry))
+                throw invalid_argument("chenc::big_int::big_uint_archive.open corrupted header");
+
+            count_ = head.count;
+            index_ = base_ + head.index_offset;
+            for (uint64_t i = 0; i < count_; i++)
+            {
+                const index_entry entry = load_entry(i);
+                if (entry.offset % alignof(uint32_t) != 0 or entry.offset > size_ or
+                    entry.blocks > (size_ - entry.offset) / sizeof(uint32_t))
+                    throw invalid_argument("chenc::big_int::big_uint_archive.open corrupted index entry " + std::to_string(i));
+            }
+        }
+
+        const unsigned char *base_ = nullptr; // 映射起始地址
+        uint64_t size_ = 0;                   // 映射长度（字节）
+        uint64_t count_ = 0;                  // 条目数量
+        const unsigned char *index_ = nullptr; // 索引区起始地址
+    };
+}
+
+#endif
@@ -8,8 +8,7 @@
 #include <limits>
 #include <cmath>
 #include <bit>
-
-#include "../time/time.hpp"
+#include <numeric>
 
 namespace chenc::tools
 {
@@ -223,6 +222,19 @@ namespace chenc::tools
 
 namespace chenc::big_int
 {
+    /**
+     * @brief 分数的化简（规范化）策略
+     * @note eager：每次运算后立即化简（默认）
+     * @note lazy：运算后不求 gcd，仅在哈希、输出分数形式或分子分母位数超过上限时化简
+     * @note manual：只在调用 normalize() 时化简
+     * @note 比较运算使用交叉相乘，不要求操作数已化简
+     */
+    enum class normalization_policy
+    {
+        eager,
+        lazy,
+        manual
+    };
     /**
      * @class fraction
      * @brief 分数类，支持有理数运算
@@ -563,6 +575,9 @@ namespace chenc::big_int
             denominator_ = value.denominator_;
             is_negative_ = value.is_negative_;
             max_bits_ = std::max(max_bits_, value.max_bits_);
+            // 保留自身的化简策略：eager 对象不接受未化简的值
+            if (policy_ == normalization_policy::eager and value.policy_ != normalization_policy::eager)
+                simplify();
             return *this;
         }
 
@@ -576,6 +591,8 @@ namespace chenc::big_int
             is_negative_ = value.is_negative_;
             value.is_negative_ = false;
             max_bits_ = std::max(max_bits_, value.max_bits_);
+            if (policy_ == normalization_policy::eager and value.policy_ != normalization_policy::eager)
+                simplify();
             return *this;
         }
         /**
@@ -630,6 +647,41 @@ namespace chenc::big_int
             return max_bits_;
         }
 
+        /**
+         * @brief 设置化简策略
+         * @param policy 化简策略
+         * @param lazy_bits lazy 策略下分子或分母超过该位数时化简，0 表示 4 * 最大精度
+         * @note 切换为 eager 时立即化简
+         * @return 自身引用
+         */
+        inline fraction &set_normalization(const normalization_policy &policy, const uint64_t &lazy_bits = 0)
+        {
+            policy_ = policy;
+            lazy_bits_ = lazy_bits;
+            if (policy_ == normalization_policy::eager)
+                simplify();
+            return *this;
+        }
+
+        /**
+         * @brief 获取化简策略
+         * @return 化简策略
+         */
+        inline normalization_policy get_normalization() const
+        {
+            return policy_;
+        }
+
+        /**
+         * @brief 立即化简（约去公因子并按最大精度截断）
+         * @return 自身引用
+         */
+        inline fraction &normalize()
+        {
+            simplify();
+            return *this;
+        }
+
         /**
          * @brief 转换为科学计数法
          * @param precision 小数点后位数
@@ -765,6 +817,8 @@ namespace chenc::big_int
          */
         inline std::pair<std::string, std::string> to_string_fraction(const int &base = 10) const
         {
+            if (policy_ != normalization_policy::eager)
+                return canonical().to_string_fraction(base);
             std::pair<std::string, std::string> result;
             result.first = numerator_.to_string(base);
             result.second = denominator_.to_string(base);
@@ -816,6 +870,22 @@ namespace chenc::big_int
             return is_negative_;
         }
 
+        /**
+         * @brief 计算哈希值（基于化简后的分子、分母与符号，不做字符串转换）
+         * @return 哈希值
+         * @note 与 operator== 一致：相等的分数哈希值相同
+         * @note 未处于 eager 策略时先在副本上化简
+         */
+        inline uint64_t hash() const
+        {
+            if (policy_ != normalization_policy::eager)
+                return canonical().hash();
+            const uint64_t numerator_hash = big_uint_view(numerator_).hash();
+            const uint64_t denominator_hash = big_uint_view(denominator_).hash();
+            return chenc::tools::hash_mix(numerator_hash ^ (is_negative_ ? 0xe7037ed1a0b428dbULL : 0),
+                                          denominator_hash ^ 0xa0761d6478bd642fULL);
+        }
+
         /**
          * @brief 比较 a == b
          * @param other 另一个分数
@@ -823,7 +893,12 @@ namespace chenc::big_int
          */
         inline bool operator==(const fraction &other) const
         {
-            return is_negative_ == other.is_negative_ && numerator_ == other.numerator_ && denominator_ == other.denominator_;
+            if (is_negative_ != other.is_negative_)
+                return false;
+            if (policy_ == normalization_policy::eager and other.policy_ == normalization_policy::eager)
+                return numerator_ == other.numerator_ && denominator_ == other.denominator_;
+            // 存在未化简的操作数：按值比较
+            return compare_magnitude(other) == 0;
         }
 
         /**
@@ -843,15 +918,10 @@ namespace chenc::big_int
          */
         inline bool operator<(const fraction &other) const
         {
-            if (!is_negative_ and !other.is_negative_)
-                return numerator_ * other.denominator_ < other.numerator_ * denominator_;
-            if (!is_negative_ and other.is_negative_)
-                return false;
-            if (is_negative_ and !other.is_negative_)
-                return true;
-            if (is_negative_ and other.is_negative_)
-                return numerator_ * other.denominator_ > other.numerator_ * denominator_;
-            return false;
+            if (is_negative_ != other.is_negative_)
+                return is_negative_;
+            const int result = compare_magnitude(other);
+            return is_negative_ ? result > 0 : result < 0;
         }
 
         /**
@@ -871,7 +941,7 @@ namespace chenc::big_int
          */
         inline bool operator<=(const fraction &other) const
         {
-            return !(*this < other);
+            return !(other < *this);
         }
 
         /**
@@ -900,15 +970,17 @@ namespace chenc::big_int
                 // 临时改变value的符号进行减法运算
                 is_negative_ = value.is_negative_;
                 *this -= value;
-                // 恢复当前分数的原始符号状态
-                is_negative_ = !is_negative_;
+                // 恢复当前分数的原始符号状态（结果为零时保持非负）
+                is_negative_ = !is_negative_ and !numerator_.is_zero();
                 return *this;
             }
 
-            // 同号分数相加
-            // a/b + c/d = (a*d + c*b) / (b*d)
-            big_uint new_numerator = numerator_ * value.denominator_ + value.numerator_ * denominator_;
-            big_uint new_denominator = denominator_ * value.denominator_;
+            // 同号分数相加（Henrici）
+            // g = gcd(b, d)，a/b + c/d = (a*(d/g) + c*(b/g)) / (b*(d/g))
+            big_uint g, value_cofactor, cofactor;
+            const bool reduced = split_denominators(value, g, value_cofactor, cofactor);
+            big_uint new_numerator = numerator_ * value_cofactor + value.numerator_ * cofactor;
+            big_uint new_denominator = denominator_ * value_cofactor;
 
             numerator_ = std::move(new_numerator);
             denominator_ = std::move(new_denominator);
@@ -916,7 +988,10 @@ namespace chenc::big_int
             // 符号保持不变（同号相加）
 
             // 化简结果
-            simplify();
+            if (reduced)
+                simplify_with_factor(g);
+            else
+                normalize_after_operation();
 
             return *this;
         }
@@ -947,18 +1022,20 @@ namespace chenc::big_int
                 // 临时改变value的符号进行加法运算
                 is_negative_ = value.is_negative_;
                 *this += value;
-                // 恢复当前分数的原始符号状态
-                is_negative_ = !is_negative_;
+                // 恢复当前分数的原始符号状态（结果为零时保持非负）
+                is_negative_ = !is_negative_ and !numerator_.is_zero();
                 return *this;
             }
 
-            // 同号分数相减
-            // a/b - c/d = (a*d - c*b) / (b*d)
+            // 同号分数相减（Henrici）
+            // g = gcd(b, d)，a/b - c/d = (a*(d/g) - c*(b/g)) / (b*(d/g))
             big_uint new_numerator, new_denominator;
+            big_uint g, value_cofactor, cofactor;
+            const bool reduced = split_denominators(value, g, value_cofactor, cofactor);
 
             // 计算交叉乘积
-            big_uint cross1 = numerator_ * value.denominator_;
-            big_uint cross2 = value.numerator_ * denominator_;
+            big_uint cross1 = numerator_ * value_cofactor;
+            big_uint cross2 = value.numerator_ * cofactor;
 
             // 判断大小以确定结果符号
             if (cross1 >= cross2)
@@ -973,13 +1050,16 @@ namespace chenc::big_int
                 is_negative_ = !is_negative_;
             }
 
-            new_denominator = denominator_ * value.denominator_;
+            new_denominator = denominator_ * value_cofactor;
 
             numerator_ = std::move(new_numerator);
             denominator_ = std::move(new_denominator);
 
             // 化简结果
-            simplify();
+            if (reduced)
+                simplify_with_factor(g);
+            else
+                normalize_after_operation();
 
             return *this;
         }
@@ -1005,9 +1085,27 @@ namespace chenc::big_int
             is_negative_ ^= value.is_negative_;
             max_bits_ = std::max(max_bits_, value.max_bits_);
 
+            if (policy_ == normalization_policy::eager and value.policy_ == normalization_policy::eager)
+            {
+                // 两操作数已化简：(a/b) * (c/d) 只需先约去 gcd(a, d) 与 gcd(c, b)，乘积即为最简
+                // （eager 分数截断后由 limit_precision 恢复最简，此前提始终成立）
+                if (numerator_.is_zero() or value.numerator_.is_zero())
+                {
+                    set_zero();
+                    return *this;
+                }
+                big_uint a, b, c, d;
+                cross_cancel(numerator_, value.denominator_, a, d);
+                cross_cancel(value.numerator_, denominator_, c, b);
+                numerator_ = a * c;
+                denominator_ = b * d;
+                limit_precision();
+                return *this;
+            }
+
             numerator_ *= value.numerator_;
             denominator_ *= value.denominator_;
-            simplify();
+            normalize_after_operation();
             return *this;
         }
 
@@ -1028,13 +1126,37 @@ namespace chenc::big_int
          */
         inline fraction &operator/=(const fraction &value)
         {
+            if (value.numerator_.is_zero())
+            {
+                throw division_by_zero("chenc::big_int::fraction.operator/= division by zero");
+            }
             is_negative_ ^= value.is_negative_;
             max_bits_ = std::max(max_bits_, value.max_bits_);
 
-            numerator_ *= value.denominator_;
+            if (policy_ == normalization_policy::eager and value.policy_ == normalization_policy::eager)
+            {
+                // 两操作数已化简：(a/b) / (c/d) 只需先约去 gcd(a, c) 与 gcd(d, b)，乘积即为最简
+                // （eager 分数截断后由 limit_precision 恢复最简，此前提始终成立）
+                if (numerator_.is_zero())
+                {
+                    set_zero();
+                    return *this;
+                }
+                big_uint a, b, c, d;
+                cross_cancel(numerator_, value.numerator_, a, c);
+                cross_cancel(value.denominator_, denominator_, d, b);
+                numerator_ = a * d;
+                denominator_ = b * c;
+                limit_precision();
+                return *this;
+            }
+
+            // value 可能与自身为同一对象：先算出新分子再修改分母
+            big_uint new_numerator = numerator_ * value.denominator_;
             denominator_ *= value.numerator_;
+            numerator_ = std::move(new_numerator);
 
-            simplify();
+            normalize_after_operation();
             return *this;
         }
 
@@ -1049,14 +1171,16 @@ namespace chenc::big_int
         }
 
         /**
-         * @brief 牛顿迭代法求平方根
-         * @param
-         * @param precision 精度要求（小数点后位数, 二进制位数）
-         * @return 平方根结果
+         * @brief 平方根
+         * @param value 被开方数（非负）
+         * @param precision 精度要求（二进制位数），与 value 的最大精度取较大者 P
+         * @return 平方根，分母为 2 的幂，按 P 位就近舍入
+         * @note 结果不小于 1 时保留 P 位小数；小于 1 时保留 P 位有效数字，与 simplify 的截断规则一致
+         * @note sqrt(a/b) * 2^K = sqrt(floor(a * 4^K / b))，只需一次整数除法与一次 big_uint::isqrt
          */
         inline static fraction sqrt(const fraction &value, const uint64_t &precision = 0)
         {
-            const uint64_t new_max_bits = std::max(value.max_bits_, precision) + 32;
+            const uint64_t max_bits = std::max(value.max_bits_, precision);
 
             if (value.is_negative_)
             {
@@ -1065,65 +1189,38 @@ namespace chenc::big_int
 
             if (value.numerator_.is_zero())
             {
-                return fraction(0, 1, std::max(value.max_bits_, precision));
+                return fraction(0, 1, max_bits);
             }
 
-            // 智能初始猜测
-            fraction x(1, 1, new_max_bits);
-            // 使用对数来估算平方根
-            // log(sqrt(x)) = log(x)/2
-            // sqrt(x) = 2^(log2(x)/2)
-
-            // 获取分子分母的位数
-            uint64_t num_bits = value.numerator_.bits();
-            uint64_t den_bits = value.denominator_.bits();
-
-            // 估算指数
-            int64_t total_bits = static_cast<int64_t>(num_bits) - static_cast<int64_t>(den_bits);
-
-            if (total_bits == 0)
+            // 计算 root = floor(sqrt(a/b) * 2^K)，多保留 guard 位用于舍入
+            uint64_t scale;
+            uint64_t guard;
+            if (value.numerator_ >= value.denominator_)
             {
-                return fraction(1, 1, std::max(value.max_bits_, precision)); // 大约是1
+                scale = max_bits + 1;
+                guard = 1;
             }
-
-            // sqrt(2^n) = 2^(n/2)
-            int64_t sqrt_bits = total_bits / 2;
-
-            if (sqrt_bits >= 0)
+            else
             {
-                // 构造 2^(sqrt_bits)
-                big_uint result(1);
-                result <<= sqrt_bits;
-                x.numerator_ = result;
+                // t = bits(a) - bits(b) < 0 时 log2(a/b) ∈ (t - 1, t + 1)，
+                // 结果的最高位 e = floor(log2(sqrt(a/b))) 满足 e_low <= e <= e_low + 1
+                const int64_t t = static_cast<int64_t>(value.numerator_.bits()) - static_cast<int64_t>(value.denominator_.bits());
+                const uint64_t e_low = static_cast<uint64_t>((2 - t) / 2); // -floor((t - 1) / 2)
+                scale = max_bits + e_low + 1;
+                guard = 0;
             }
-            else
+            const big_uint root = big_uint::isqrt((value.numerator_ << (2 * scale)) / value.denominator_);
+            if (guard == 0)
             {
-                // 构造 1/2^(-sqrt_bits)
-                big_uint result(1);
-                result <<= (-sqrt_bits);
-                x.denominator_ = result;
+                // 使结果的分子恰好保留 max_bits 位（guard 为 1 或 2）
+                guard = root.bits() - max_bits;
             }
 
-            // 牛顿迭代，带自适应停止条件
-            const fraction half(1, 2, new_max_bits);
-            fraction tolerance(1, big_uint::pow(2, std::max(value.max_bits_, precision)) + 4, new_max_bits);
-
-            for (int i = 0;; i++)
-            { // 限制迭代次数
-                if (i >= 100)
-                    throw std::runtime_error("chenc::big_int::fraction.sqrt iteration count exceeded");
-                fraction x_prev = x;
-                auto temp = value;
-                temp.max_bits_ = new_max_bits;
-                x = half * (x + (temp /= x));
-
-                // 检查收敛
-                fraction error = x > x_prev ? x - x_prev : x_prev - x;
-                if (error < tolerance)
-                    break;
-            }
-            x.max_bits_ = std::max(value.max_bits_, precision);
-            return x;
+            fraction result(max_bits);
+            result.numerator_ = (root + (big_uint(1) << (guard - 1))) >> guard;
+            result.denominator_ = big_uint(1) << (scale - guard);
+            result.simplify();
+            return result;
         }
 
         /**
@@ -1271,8 +1368,12 @@ namespace chenc::big_int
             {
                 term *= y_squared;
                 // 避免创建临时对象 fraction(n, 1, ...)
+                // term 已是最简，新的公因子只可能来自 n；约去后 next_term 仍为最简，供 Henrici 加法使用
                 fraction next_term = term;
-                next_term.denominator_ *= n;
+                const uint64_t common = std::gcd(static_cast<uint64_t>(next_term.numerator_ % n), n);
+                if (common != 1)
+                    next_term.numerator_ /= common;
+                next_term.denominator_ *= n / common;
 
                 // 检查收敛
                 // 使用交叉相乘避免除法: a/b < c/d  -> a*d < b*c
@@ -1339,23 +1440,254 @@ namespace chenc::big_int
             return sum;
         }
         /**
-         * @brief 化简分数
-         * @note 使用最大公约数化简分子和分母
+         * @brief 返回化简后的 eager 副本（用于哈希与分数形式输出）
+         * @return 副本
          */
-        void simplify()
+        inline fraction canonical() const
         {
-            if (numerator_.is_one() || denominator_.is_one())
+            fraction result(*this);
+            result.policy_ = normalization_policy::eager;
+            result.simplify();
+            return result;
+        }
+        /**
+         * @brief 加减法的分母拆分：g = gcd(b, d)，其中 b、d 为自身与 value 的分母
+         * @param value 另一操作数
+         * @param g 分母的最大公约数
+         * @param value_cofactor d / g
+         * @param cofactor b / g
+         * @return 是否求了 g（两操作数均为 eager 即已化简时）；否则 g 为 1，余因子为原分母
+         * @note 分母相等时 g 即为分母，不必求 gcd；任一分母为 1 时 g 为 1
+         */
+        inline bool split_denominators(const fraction &value, big_uint &g, big_uint &value_cofactor, big_uint &cofactor) const
+        {
+            const bool reduced = policy_ == normalization_policy::eager and value.policy_ == normalization_policy::eager;
+            if (!reduced or denominator_.is_one() or value.denominator_.is_one())
+                g = 1;
+            else if (denominator_ == value.denominator_)
+                g = denominator_;
+            else
+                g = big_uint::gcd(denominator_, value.denominator_);
+
+            if (g.is_one())
             {
+                value_cofactor = value.denominator_;
+                cofactor = denominator_;
+            }
+            else
+            {
+                value_cofactor = value.denominator_ / g;
+                cofactor = denominator_ / g;
+            }
+            return reduced;
+        }
+        /**
+         * @brief 比较绝对值 |a/b| 与 |c/d|，即比较 a*d 与 c*b
+         * @param other 另一个分数
+         * @return -1、0、1 分别表示小于、等于、大于
+         * @note 依次尝试：两个乘积的位数、64 位尾数区间、截断高位乘积区间，均无法判定时才计算完整乘积
+         * @note 不要求操作数已化简
+         */
+        inline int compare_magnitude(const fraction &other) const
+        {
+            const big_uint &a = numerator_, &b = denominator_;
+            const big_uint &c = other.numerator_, &d = other.denominator_;
+            if (a.is_zero() or c.is_zero())
+                return static_cast<int>(!a.is_zero()) - static_cast<int>(!c.is_zero());
+
+#ifdef __SIZEOF_INT128__
+            if (a.blocks() <= 2 and b.blocks() <= 2 and c.blocks() <= 2 and d.blocks() <= 2)
+            {
+                // 均不超过 64 位：128 位乘积精确比较
+                const unsigned __int128 left = static_cast<unsigned __int128>(static_cast<uint64_t>(a)) * static_cast<uint64_t>(d);
+                const unsigned __int128 right = static_cast<unsigned __int128>(static_cast<uint64_t>(c)) * static_cast<uint64_t>(b);
+                return (left > right) - (left < right);
+            }
+#endif
+
+            // 1. 位数：x*y ∈ [2^(bits(x)+bits(y)), 2^(bits(x)+bits(y)+2))
+            const uint64_t left_bits = a.bits() + d.bits();
+            const uint64_t right_bits = c.bits() + b.bits();
+            if (left_bits >= right_bits + 2)
+                return 1;
+            if (right_bits >= left_bits + 2)
+                return -1;
+
+#ifdef __SIZEOF_INT128__
+            // 2. 取各操作数最高 63 位 m：x ∈ [m, m+1] * 2^(位数-63)，乘积区间在 126 位内不会溢出
+            {
+                const auto [ma, ea] = a.frexp();
+                const auto [mb, eb] = b.frexp();
+                const auto [mc, ec] = c.frexp();
+                const auto [md, ed] = d.frexp();
+                using uint128 = unsigned __int128;
+                uint128 left_low = static_cast<uint128>(ma >> 1) * (md >> 1);
+                uint128 left_high = static_cast<uint128>((ma >> 1) + 1) * ((md >> 1) + 1);
+                uint128 right_low = static_cast<uint128>(mc >> 1) * (mb >> 1);
+                uint128 right_high = static_cast<uint128>((mc >> 1) + 1) * ((mb >> 1) + 1);
+                // 位数筛选后两侧指数至多相差 1
+                if (ea + ed > ec + eb)
+                {
+                    left_low <<= 1;
+                    left_high <<= 1;
+                }
+                else if (ec + eb > ea + ed)
+                {
+                    right_low <<= 1;
+                    right_high <<= 1;
+                }
+                if (left_low > right_high)
+                    return 1;
+                if (left_high < right_low)
+                    return -1;
+            }
+#endif
+
+            // 相同的分子分母（如重复元素）直接判等
+            if (a == c and b == d)
+                return 0;
+
+            // 3. 截断到最高 window 位后的乘积区间
+            constexpr uint64_t window = 256;
+            if (a.bits() >= window or b.bits() >= window or c.bits() >= window or d.bits() >= window)
+            {
+                // x = x_high * 2^shift + 余项，x ∈ [x_high, x_high + 1] * 2^shift（shift 为 0 时精确）
+                const auto truncate = [](const big_uint &x, uint64_t &shift)
+                {
+                    shift = x.bits() >= window ? x.bits() + 1 - window : 0;
+                    return x >> shift;
+                };
+                uint64_t sa, sb, sc, sd;
+                const big_uint a_high = truncate(a, sa), b_high = truncate(b, sb);
+                const big_uint c_high = truncate(c, sc), d_high = truncate(d, sd);
+                big_uint left_low = a_high * d_high;
+                big_uint left_high = (a_high + static_cast<uint64_t>(sa != 0)) * (d_high + static_cast<uint64_t>(sd != 0));
+                big_uint right_low = c_high * b_high;
+                big_uint right_high = (c_high + static_cast<uint64_t>(sc != 0)) * (b_high + static_cast<uint64_t>(sb != 0));
+                // 对齐两侧的指数
+                const uint64_t left_shift = sa + sd, right_shift = sc + sb;
+                if (left_shift > right_shift)
+                {
+                    left_low <<= left_shift - right_shift;
+                    left_high <<= left_shift - right_shift;
+                }
+                else if (right_shift > left_shift)
+                {
+                    right_low <<= right_shift - left_shift;
+                    right_high <<= right_shift - left_shift;
+                }
+                if (left_low > right_high)
+                    return 1;
+                if (left_high < right_low)
+                    return -1;
+            }
+
+            // 4. 完整交叉乘积
+            const big_uint left = a * d;
+            const big_uint right = c * b;
+            return (left > right) - (left < right);
+        }
+        /**
+         * @brief 交叉约分：x_out = x / gcd(x, y)，y_out = y / gcd(x, y)
+         * @param x 输入
+         * @param y 输入
+         * @param x_out 输出
+         * @param y_out 输出
+         * @note 任一输入为 1 时不求 gcd
+         */
+        inline static void cross_cancel(const big_uint &x, const big_uint &y, big_uint &x_out, big_uint &y_out)
+        {
+            if (!x.is_one() and !y.is_one())
+            {
+                const big_uint g = big_uint::gcd(x, y);
+                if (!g.is_one())
+                {
+                    x_out = x / g;
+                    y_out = y / g;
+                    return;
+                }
+            }
+            x_out = x;
+            y_out = y;
+        }
+        /**
+         * @brief 置为 0（分母为 1，非负）
+         */
+        inline void set_zero()
+        {
+            numerator_ = 0;
+            denominator_ = 1;
+            is_negative_ = false;
+        }
+        /**
+         * @brief Henrici 加减法后的化简
+         * @param g 两分母的最大公约数
+         * @note 两操作数已化简时，分子与 b*(d/g) 的公因子只可能来自 g，
+         *       因此只需求 gcd(分子, g)；g 为 1 时结果已是最简
+         */
+        inline void simplify_with_factor(const big_uint &g)
+        {
+            if (numerator_.is_zero())
+            {
+                set_zero();
+                return;
+            }
+            if (!g.is_one())
+            {
+                const big_uint common = big_uint::gcd(numerator_, g);
+                if (!common.is_one())
+                {
+                    numerator_ /= common;
+                    denominator_ /= common;
+                }
+            }
+            limit_precision();
+        }
+        /**
+         * @brief 运算结束后按化简策略处理结果
+         * @note eager 直接化简；其他策略只规范零的表示，lazy 在位数超限时化简
+         */
+        inline void normalize_after_operation()
+        {
+            if (policy_ == normalization_policy::eager)
+            {
+                simplify();
                 return;
             }
+            if (denominator_.is_zero())
+            {
+                throw division_by_zero("chenc::big_int::fraction.normalize_after_operation denominator_ is zero");
+            }
+            if (numerator_.is_zero())
+            {
+                set_zero();
+                return;
+            }
+            if (policy_ == normalization_policy::lazy)
+            {
+                const uint64_t limit = lazy_bits_ != 0 ? lazy_bits_ : (max_bits_ > UINT64_MAX / 4 ? UINT64_MAX : max_bits_ * 4);
+                if (numerator_.bits() > limit or denominator_.bits() > limit)
+                    simplify();
+            }
+        }
+        /**
+         * @brief 化简分数
+         * @note 使用最大公约数化简分子和分母
+         */
+        void simplify()
+        {
             if (denominator_ == 0)
             {
                 throw division_by_zero("chenc::big_int::fraction.simplify denominator_ is zero");
             }
+            // 零须在分母为 1 的快速返回之前规范，否则 -0/1 会保留负号
             if (numerator_ == 0)
             {
-                denominator_ = 1;
-                is_negative_ = false;
+                set_zero();
+                return;
+            }
+            if (numerator_.is_one() || denominator_.is_one())
+            {
                 return;
             }
             if (numerator_ == denominator_)
@@ -1365,34 +1697,73 @@ namespace chenc::big_int
                 return;
             }
 
-            // 使用 big_uint 的 GCD 方法化简
-            // 性能影响高，精度关系大
-            big_uint gcd = big_uint::gcd(numerator_, denominator_);
-            // std::cout << "gcd: " << gcd << std::endl;
-            if (gcd > 1)
+            if (numerator_.blocks() <= 2 and denominator_.blocks() <= 2)
+            {
+                // 分子分母均不超过 64 位：直接使用内建整数化简
+                const uint64_t numerator = static_cast<uint64_t>(numerator_);
+                const uint64_t denominator = static_cast<uint64_t>(denominator_);
+                const uint64_t gcd = std::gcd(numerator, denominator);
+                if (gcd > 1)
+                {
+                    numerator_ = numerator / gcd;
+                    denominator_ = denominator / gcd;
+                }
+                if (max_bits_ >= 64)
+                    return;
+            }
+            else if (const uint64_t denominator_shift = denominator_.bit_trailing_zero_count();
+                     denominator_shift == denominator_.bits())
             {
-                numerator_ = numerator_ / gcd;
-                denominator_ = denominator_ / gcd;
+                // 分母为 2 的幂（如由 double 构造）：公约数只含因子 2，直接移位
+                const uint64_t shift = std::min(numerator_.bit_trailing_zero_count(), denominator_shift);
+                numerator_ >>= shift;
+                denominator_ >>= shift;
+            }
+            else
+            {
+                // 使用 big_uint 的 GCD 方法化简
+                // 性能影响高，精度关系大
+                big_uint gcd = big_uint::gcd(numerator_, denominator_);
+                // std::cout << "gcd: " << gcd << std::endl;
+                if (gcd > 1)
+                {
+                    numerator_ = numerator_ / gcd;
+                    denominator_ = denominator_ / gcd;
+                }
             }
 
-            // 精度超限
+            limit_precision();
+        }
+        /**
+         * @brief 精度超限时将分子分母同时右移，使较小者不超过 max_bits_ 位，并恢复最简形式
+         */
+        inline void limit_precision()
+        {
             uint64_t numerator_bits = numerator_.bits();     // 分子
             uint64_t denominator_bits = denominator_.bits(); // 分母
+            uint64_t shift = 0;
             if (denominator_bits > numerator_bits)
             {
                 if (numerator_bits > max_bits_)
-                {
-                    numerator_ >>= (numerator_bits - max_bits_);
-                    denominator_ >>= (numerator_bits - max_bits_);
-                }
+                    shift = numerator_bits - max_bits_;
             }
             else
             {
                 if (denominator_bits > max_bits_)
-                {
-                    numerator_ >>= (denominator_bits - max_bits_);
-                    denominator_ >>= (denominator_bits - max_bits_);
-                }
+                    shift = denominator_bits - max_bits_;
+            }
+            if (shift == 0)
+                return;
+
+            numerator_ >>= shift;
+            denominator_ >>= shift;
+            // 截断后分子分母可能重新产生公因子（如 83333/83333）；较小者不超过 max_bits_ 位，
+            // 在此恢复最简形式，使 Henrici 加减与交叉约分乘除可以假定 eager 操作数已化简
+            const big_uint gcd = big_uint::gcd(numerator_, denominator_);
+            if (!gcd.is_one())
+            {
+                numerator_ /= gcd;
+                denominator_ /= gcd;
             }
         }
 
@@ -1400,6 +1771,20 @@ namespace chenc::big_int
         big_uint denominator_; // 分母
         bool is_negative_;     // 是否为负数
         uint64_t max_bits_;    // 最大有效精度
+        normalization_policy policy_ = normalization_policy::eager; // 化简策略
+        uint64_t lazy_bits_ = 0;                                     // lazy 策略下分子分母的位数上限，0 表示 4 * max_bits_
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<chenc::big_int::fraction>
+    {
+        std::size_t operator()(const chenc::big_int::fraction &fraction) const
+        {
+            return static_cast<std::size_t>(fraction.hash());
+        }
     };
 }
 
@@ -0,0 +1,65 @@
+// fraction 最简形式回归检查：截断后的 eager 分数参与运算，结果须与精确值化简后再截断一致
+// 运行：tests/run_tests.sh（或 g++ -std=c++23 -I.. fraction_lowest_terms.cpp）
+#include "../fraction.hpp"
+
+#include <iostream>
+
+namespace
+{
+    using chenc::big_int::fraction;
+
+    int failures = 0;
+
+    void check(const bool &condition, const char *message)
+    {
+        if (!condition)
+        {
+            std::cerr << "FAILED: " << message << "\n";
+            ++failures;
+        }
+    }
+
+    bool is_lowest_terms(const fraction &value)
+    {
+        return chenc::big_int::big_uint::gcd(value.numerator(), value.denominator()).is_one();
+    }
+}
+
+int main()
+{
+    // 1000002/999999 截断到 16 位时曾保存为 83333/83333
+    const fraction truncated(1000002u, 999999u, 16);
+    check(is_lowest_terms(truncated), "truncated value is in lowest terms");
+
+    // Henrici 加法
+    const fraction sum = truncated + fraction(1, 1, 16);
+    check(sum == fraction(2, 1, 16), "truncated + 1 == 2");
+    check(sum.hash() == fraction(2, 1, 16).hash(), "hash(truncated + 1) == hash(2)");
+
+    // 交叉约分乘除
+    const fraction product = truncated * fraction(3, 1, 16);
+    check(product == fraction(3, 1, 16), "truncated * 3 == 3");
+    const fraction quotient = fraction(3, 1, 16) / truncated;
+    check(quotient == fraction(3, 1, 16), "3 / truncated == 3");
+    check(is_lowest_terms(product) and is_lowest_terms(quotient), "products are in lowest terms");
+
+    fraction harmonic(0, 1);
+    for (int k = 1; k <= 400; k++)
+        harmonic += fraction(1, k);
+    check(is_lowest_terms(harmonic), "H_400 at default precision is in lowest terms");
+
+    // natural_log 的级数项 term / n 曾未约去与 n 的公因子
+    const fraction log_value = fraction::log(fraction(2, 1), fraction(7, 2), 24);
+    check(is_lowest_terms(log_value), "log_2(7/2) is in lowest terms");
+    check(log_value == fraction(log_value.numerator(), log_value.denominator()), "log_2(7/2) equals its reduced form");
+    check(log_value.hash() == fraction(log_value.numerator(), log_value.denominator()).hash(), "hash(log_2(7/2)) matches its reduced form");
+    for (int k = 2; k <= 30; k++)
+    {
+        check(is_lowest_terms(fraction::log(fraction(3, 1), fraction(k, 2), 8)), "log_3(k/2) at 8 bits is in lowest terms");
+        check(is_lowest_terms(fraction::log(fraction(k + 1, k), fraction(10, 1), 64)), "log_(1+1/k)(10) at 64 bits is in lowest terms");
+    }
+
+    if (failures == 0)
+        std::cout << "all checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
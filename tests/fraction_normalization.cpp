@@ -0,0 +1,100 @@
+// fraction 化简策略回归检查：不同策略的操作数混合运算得到 0 时，结果须为唯一的非负零
+// 运行：tests/run_tests.sh（或 g++ -std=c++23 -I.. fraction_normalization.cpp）
+#include "../fraction.hpp"
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    using chenc::big_int::fraction;
+    using chenc::big_int::normalization_policy;
+
+    int failures = 0;
+
+    void check(const bool &condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "FAILED: " << message << "\n";
+            ++failures;
+        }
+    }
+
+    fraction with_policy(fraction value, const normalization_policy &policy)
+    {
+        value.set_normalization(policy);
+        return value;
+    }
+
+    const char *policy_name(const normalization_policy &policy)
+    {
+        switch (policy)
+        {
+        case normalization_policy::eager:
+            return "eager";
+        case normalization_policy::lazy:
+            return "lazy";
+        default:
+            return "manual";
+        }
+    }
+
+    void check_zero(const fraction &value, const std::string &message)
+    {
+        const fraction zero(0, 1);
+        check(!value.is_negative(), message + " is not negative");
+        check(value == zero, message + " == 0");
+        check(value.hash() == zero.hash(), message + " hashes as 0");
+        check(value.numerator().is_zero() and value.denominator().is_one(), message + " is stored as 0/1");
+    }
+}
+
+int main()
+{
+    using operation = std::function<fraction(const fraction &, const fraction &)>;
+    struct zero_case
+    {
+        const char *name;
+        fraction left;
+        fraction right;
+        operation apply;
+    };
+    const zero_case cases[] = {
+        {"-2 - -2", fraction(-2, 1), fraction(-2, 1), [](const fraction &a, const fraction &b) { return a - b; }},
+        {"-2 + 2", fraction(-2, 1), fraction(2, 1), [](const fraction &a, const fraction &b) { return a + b; }},
+        {"-3/7 - -3/7", fraction(-3, 7), fraction(-3, 7), [](const fraction &a, const fraction &b) { return a - b; }},
+        {"-5 * 0", fraction(-5, 1), fraction(0, 1), [](const fraction &a, const fraction &b) { return a * b; }},
+        {"0 * -5", fraction(0, 1), fraction(-5, 1), [](const fraction &a, const fraction &b) { return a * b; }},
+        {"-5/3 * 0", fraction(-5, 3), fraction(0, 1), [](const fraction &a, const fraction &b) { return a * b; }},
+        {"0 / -5", fraction(0, 1), fraction(-5, 1), [](const fraction &a, const fraction &b) { return a / b; }},
+        {"0 / -5/3", fraction(0, 1), fraction(-5, 3), [](const fraction &a, const fraction &b) { return a / b; }},
+    };
+    const normalization_policy policies[] = {normalization_policy::eager, normalization_policy::lazy, normalization_policy::manual};
+
+    for (const zero_case &item : cases)
+    {
+        for (const normalization_policy &left_policy : policies)
+        {
+            for (const normalization_policy &right_policy : policies)
+            {
+                const std::string message = std::string(item.name) + " (" + policy_name(left_policy) + " op " + policy_name(right_policy) + ")";
+                const fraction result = item.apply(with_policy(item.left, left_policy), with_policy(item.right, right_policy));
+                check_zero(result, message);
+            }
+        }
+    }
+
+    // 复合赋值同样须规范零
+    fraction value(-2, 1);
+    value -= with_policy(fraction(-2, 1), normalization_policy::lazy);
+    check_zero(value, "eager -= lazy");
+    value = fraction(-5, 1);
+    value *= with_policy(fraction(0, 1), normalization_policy::manual);
+    check_zero(value, "eager *= manual");
+
+    if (failures == 0)
+        std::cout << "all checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+#!/bin/sh
+# 编译并运行 tests 目录下的全部回归检查
+# 用法：tests/run_tests.sh [额外编译参数]，如 tests/run_tests.sh -DCHENC_BIG_UINT_COW
+# 编译器由 CXX 指定（默认 g++），需支持 C++23 与 <stdfloat>
+set -u
+
+cd "$(dirname "$0")" || exit 1
+CXX=${CXX:-g++}
+OUT=${TMPDIR:-/tmp}/chenc_big_int_tests
+mkdir -p "$OUT" || exit 1
+
+failed=0
+for source in *.cpp; do
+    name=${source%.cpp}
+    if ! $CXX -std=c++23 -O2 -I.. "$@" "$source" -o "$OUT/$name"; then
+        echo "BUILD FAILED: $name"
+        failed=$((failed + 1))
+        continue
+    fi
+    if "$OUT/$name"; then
+        echo "PASSED: $name"
+    else
+        echo "FAILED: $name"
+        failed=$((failed + 1))
+    fi
+done
+
+exit $((failed != 0))